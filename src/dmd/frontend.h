@@ -2995,9 +2995,6 @@ public:
     int32_t rootimports;
     bool rootImports();
     int32_t insearch;
-    Identifier* searchCacheIdent;
-    Dsymbol* searchCacheSymbol;
-    int32_t searchCacheFlags;
     Module* importedFrom;
     Array<Dsymbol* >* decldefs;
     Array<Module* > aimports;
@@ -6974,6 +6971,8 @@ struct Param
     bool vgc;
     bool vfield;
     bool vcomplex;
+    bool vbackendmem;
+    bool vflowstats;
     uint8_t symdebug;
     bool symdebugref;
     bool alwaysframe;
@@ -7043,6 +7042,8 @@ struct Param
     CHECKENABLE boundscheck;
     CHECKACTION checkAction;
     uint32_t errorLimit;
+    uint32_t ctfeMemLimit;
+    uint32_t hashLongSymbols;
     _d_dynamicArray< const char > argv0;
     Array<const char* > modFileAliasStrings;
     Array<const char* >* imppath;
@@ -7076,6 +7077,8 @@ struct Param
     _d_dynamicArray< const char > mscrtlib;
     _d_dynamicArray< const char > moduleDepsFile;
     OutBuffer* moduleDeps;
+    _d_dynamicArray< const char > timeTraceFile;
+    uint32_t timeTraceGranularity;
     MessageStyle messageStyle;
     bool debugb;
     bool debugc;
@@ -7113,6 +7116,8 @@ struct Param
         vgc(),
         vfield(),
         vcomplex(),
+        vbackendmem(),
+        vflowstats(),
         symdebug(),
         symdebugref(),
         alwaysframe(),
@@ -7181,6 +7186,8 @@ struct Param
         boundscheck((CHECKENABLE)0u),
         checkAction((CHECKACTION)0u),
         errorLimit(20u),
+        ctfeMemLimit(),
+        hashLongSymbols(),
         argv0(),
         modFileAliasStrings(),
         imppath(),
@@ -7212,6 +7219,8 @@ struct Param
         mscrtlib(),
         moduleDepsFile(),
         moduleDeps(),
+        timeTraceFile(),
+        timeTraceGranularity(500u),
         messageStyle((MessageStyle)0u),
         debugb(),
         debugc(),
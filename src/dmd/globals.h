@@ -137,6 +137,8 @@ struct Param
     bool vgc;           // identify gc usage
     bool vfield;        // identify non-mutable field variables
     bool vcomplex;      // identify complex/imaginary type usage
+    bool vbackendmem;   // report peak backend memory use per function
+    bool vflowstats;    // report dataflow analysis work per function
     unsigned char symdebug;  // insert debug symbolic information
     bool symdebugref;   // insert debug information for all referenced types, too
     bool alwaysframe;   // always emit standard stack frame
@@ -212,6 +214,8 @@ struct Param
     CHECKACTION checkAction;       // action to take when bounds, asserts or switch defaults are violated
 
     unsigned errorLimit;
+    unsigned ctfeMemLimit;      // megabytes of memory a CTFE evaluation may allocate, 0 for no limit
+    unsigned hashLongSymbols;   // hash symbol names longer than this in ELF object files, 0 for never
 
     DString  argv0;    // program name
     Array<const char *> modFileAliasStrings; // array of char*'s of -I module filename alias strings
@@ -255,6 +259,8 @@ struct Param
 
     DString moduleDepsFile;     // filename for deps output
     OutBuffer *moduleDeps;      // contents to be written to deps file
+    DString timeTraceFile;      // filename for -ftime-trace output
+    unsigned timeTraceGranularity; // minimum duration in microseconds of a traced event
     MessageStyle messageStyle;  // style of file/line annotations on messages
 
     // Hidden debug switches
@@ -87,10 +87,7 @@ public:
     int rootimports;            // 0: don't know, 1: does not, 2: does
     bool rootImports();         // returns true if module imports root module
 
-    int insearch;
-    Identifier *searchCacheIdent;
-    Dsymbol *searchCacheSymbol; // cached value of search
-    int searchCacheFlags;       // cached flags
+    int insearch;               // 0, or the depth of the search() in progress
 
     // module from command line we're imported from,
     // i.e. a module that will be taken all the